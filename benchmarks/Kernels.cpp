@@ -0,0 +1,119 @@
+#include "Benchmark.H"
+
+// Micro-benchmarks of the patch kernels: Stencil apply, forall, BoxData copy and
+// linearOut. Each kernel is applied to every patch of a LevelBoxData covering the
+// domain, with the patches distributed over the threads of the ThreadPool.
+
+template<unsigned int C>
+void benchmarkForall(Benchmark& a_bench, const DisjointBoxLayout& a_layout)
+{
+    LevelBoxData<double, C> src(a_layout, Point::Zeros());
+    LevelBoxData<double, C> dst(a_layout, Point::Zeros());
+    src.setVal(1.0);
+    dst.setVal(0.0);
+    Benchmark::Work work;
+    for (auto iter : a_layout) { work.cells += a_layout[iter].size(); }
+    work.bytes = work.cells*3*C*sizeof(double);
+    work.flops = work.cells*2*C;
+    a_bench.run("forall/C" + std::to_string(C), work, [&]()
+    {
+        a_layout.parallelForEach([&](const LevelIndex& a_index)
+        {
+            forallInPlace(
+                [] PROTO_LAMBDA (Var<double, C>& a_dst, Var<double, C>& a_src)
+                {
+                    for (int cc = 0; cc < C; cc++)
+                    {
+                        a_dst(cc) += 0.5*a_src(cc);
+                    }
+                }, dst[a_index], src[a_index]);
+        });
+    });
+}
+
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Benchmark bench("kernels");
+    bench.parse(argc, argv);
+    auto layout = bench.layout();
+    double localCells = 0;
+    for (auto iter : layout) { localCells += layout[iter].size(); }
+
+    // STENCIL APPLY
+    {
+        std::vector<std::pair<std::string, Stencil<double>>> stencils;
+        stencils.push_back({"Laplacian", Stencil<double>::Laplacian()});
+#if DIM == 3
+        stencils.push_back({"Laplacian_27", Stencil<double>::Laplacian_27()});
+#elif DIM == 2
+        stencils.push_back({"Laplacian_9", Stencil<double>::Laplacian_9()});
+#endif
+        Stencil<double> L4;
+        for (int dir = 0; dir < DIM; dir++) { L4 += Stencil<double>::Derivative(2, dir, 4); }
+        stencils.push_back({"Laplacian4", L4});
+
+        LevelBoxData<double> src(layout, Point::Ones(2));
+        LevelBoxData<double> dst(layout, Point::Zeros());
+        src.setVal(1.0);
+        for (auto& stencil : stencils)
+        {
+            auto& S = stencil.second;
+            Benchmark::Work work;
+            work.cells = localCells;
+            work.bytes = localCells*2*sizeof(double);
+            work.flops = 0;
+            for (auto iter : layout) { work.flops += S.numFlops(layout[iter]); }
+            bench.run("Stencil::apply/" + stencil.first, work, [&]()
+            {
+                layout.parallelForEach([&](const LevelIndex& a_index)
+                {
+                    dst[a_index] |= S(src[a_index]);
+                });
+            });
+        }
+    }
+
+    // FORALL
+    benchmarkForall<1>(bench, layout);
+    benchmarkForall<5>(bench, layout);
+    benchmarkForall<10>(bench, layout);
+
+    // COPY AND LINEAR OUT
+    {
+        constexpr unsigned int C = 5;
+        LevelBoxData<double, C> src(layout, Point::Zeros());
+        LevelBoxData<double, C> dst(layout, Point::Zeros());
+        src.setVal(1.0);
+        Benchmark::Work work;
+        work.cells = localCells;
+        work.bytes = localCells*2*C*sizeof(double);
+        work.flops = 0;
+        bench.run("BoxData::copyTo", work, [&]()
+        {
+            layout.parallelForEach([&](const LevelIndex& a_index)
+            {
+                src[a_index].copyTo(dst[a_index]);
+            });
+        });
+
+        std::vector<std::vector<double>> buffers(layout.localSize());
+        for (int ii = 0; ii < layout.localSize(); ii++)
+        {
+            buffers[ii].resize(src[layout.localIndex(ii)].linearSize() / sizeof(double));
+        }
+        bench.run("BoxData::linearOut", work, [&]()
+        {
+            ThreadPool::getPool().forEach(layout.localSize(), [&](unsigned int a_ii)
+            {
+                auto index = layout.localIndex(a_ii);
+                src[index].linearOut(buffers[a_ii].data(), layout[index], CInterval(0, C-1));
+            });
+        });
+    }
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
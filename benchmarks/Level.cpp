@@ -0,0 +1,70 @@
+#include "Benchmark.H"
+
+// Benchmarks of the level operations: ghost cell exchange of a LevelBoxData, and the
+// averageDown and interpBoundaries operations between a coarse level covering the
+// domain and a fine level, refined by 2, covering its middle half in each direction.
+
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    int ghost = 2;
+    Benchmark bench("level");
+    bench.args().add("ghost", ghost);
+    bench.parse(argc, argv);
+    auto layout = bench.layout();
+    constexpr unsigned int C = 5;
+
+    // EXCHANGE
+    {
+        LevelBoxData<double, C> data(layout, Point::Ones(ghost));
+        data.setVal(1.0);
+        Benchmark::Work work;
+        for (auto iter : layout)
+        {
+            work.cells += data[iter].box().size() - layout[iter].size();
+        }
+        work.bytes = work.cells*2*C*sizeof(double);
+        work.flops = 0;
+        bench.run("LevelBoxData::exchange", work, [&]() { data.exchange(); });
+    }
+
+    // AVERAGE DOWN AND INTERP BOUNDARIES
+    int refRatio = 2;
+    int domainSize = bench.domainSize();
+    PROTO_ASSERT(domainSize % (2*bench.boxSize()) == 0,
+            "Level benchmark | Error: domainSize must be a multiple of 2*boxSize.");
+    Box fineRegion = Box::Cube(domainSize).grow(-domainSize/4).refine(refRatio);
+    DisjointBoxLayout fineLayout(layout.domain().refine(refRatio), fineRegion,
+            Point::Ones(bench.boxSize()));
+    LevelBoxData<double, C> crse(layout, Point::Ones(ghost));
+    LevelBoxData<double, C> fine(fineLayout, Point::Ones(ghost));
+    crse.setVal(1.0);
+    fine.setVal(1.0);
+    {
+        auto AVG = Stencil<double>::AvgDown(refRatio);
+        Benchmark::Work work;
+        for (auto iter : fineLayout)
+        {
+            work.cells += fineLayout[iter].size();
+            work.flops += AVG.numFlops(fineLayout[iter].coarsen(refRatio));
+        }
+        work.bytes = work.cells*(1.0 + 1.0/ipow<DIM>(refRatio))*C*sizeof(double);
+        bench.run("averageDown", work, [&]() { averageDown(crse, fine, refRatio); });
+    }
+    {
+        auto interp = InterpStencil<double>::FiniteVolume(Point::Ones(refRatio), 5);
+        Benchmark::Work work;
+        for (auto iter : fineLayout)
+        {
+            if (!fineLayout.onLevelBoundary(fineLayout.point(iter))) { continue; }
+            work.cells += fine[iter].box().size() - fineLayout[iter].size();
+        }
+        work.bytes = work.cells*(1.0 + 1.0/ipow<DIM>(refRatio))*C*sizeof(double);
+        bench.run("interpBoundaries", work, [&]() { interpBoundaries(crse, fine, interp); });
+    }
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
@@ -0,0 +1,82 @@
+#include "Benchmark.H"
+#include "LevelSolver_FASMultigrid.H"
+#include "BoxOp_Laplace.H"
+#include "LevelRK4.H"
+#include "BoxOp_Euler.H"
+
+// Benchmarks of whole solver steps built from the operators in examples/_common: a
+// single FAS multigrid V-cycle for the Laplacian, and a fourth order RK4 step of the
+// compressible Euler equations. The bytes are the compulsory traffic of the state:
+// the solution and right hand side read and the solution written once per V-cycle,
+// the state read and written once per stage of RK4. Their operation counts are not
+// known, so they report null GFLOP/s.
+
+PROTO_KERNEL_START
+void f_rhsF(Point& a_pt, Var<double>& a_rhs, double a_dx)
+{
+    a_rhs(0) = 1.0;
+    for (int dir = 0; dir < DIM; dir++)
+    {
+        a_rhs(0) *= sin(2.0*M_PI*(a_pt[dir] + 0.5)*a_dx);
+    }
+}
+PROTO_KERNEL_END(f_rhsF, f_rhs)
+
+PROTO_KERNEL_START
+void f_eulerStateF(Point& a_pt, Var<double, DIM+2>& a_U, double a_dx)
+{
+    double gamma = 1.4;
+    double rho = 1.0 + 0.01*sin(2.0*M_PI*(a_pt[0] + 0.5)*a_dx);
+    a_U(0) = rho;
+    for (int dir = 1; dir <= DIM; dir++) { a_U(dir) = 0.0; }
+    a_U(DIM+1) = pow(rho, gamma)/(gamma - 1.0);
+}
+PROTO_KERNEL_END(f_eulerStateF, f_eulerState)
+
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    Benchmark bench("solvers");
+    bench.parse(argc, argv);
+    auto layout = bench.layout();
+    double dx = 1.0/bench.domainSize();
+    double localCells = 0;
+    for (auto iter : layout) { localCells += layout[iter].size(); }
+
+    // MULTIGRID V-CYCLE
+    {
+        typedef BoxOp_Laplace<double> OP;
+        int numLevels = log(1.0*bench.domainSize())/log(2.0) + 1;
+        LevelSolver_FASMultigrid<BoxOp_Laplace, double> solver(
+                layout, Point::Ones(2), numLevels, dx);
+        LevelBoxData<double, OP::numState()> phi(layout, OP::ghost());
+        LevelBoxData<double, OP::numState()> rhs(layout, Point::Zeros());
+        phi.setToZero();
+        rhs.initialize(f_rhs, dx);
+        Benchmark::Work work;
+        work.cells = localCells;
+        work.bytes = localCells*3*sizeof(double);
+        bench.run("Multigrid::vCycle", work, [&]() { solver.solve(phi, rhs, 1, 0.0); });
+    }
+
+    // EULER RK4 STEP
+    {
+        typedef BoxOp_Euler<double> OP;
+        LevelRK4<BoxOp_Euler, double> integrator(layout, dx);
+        LevelBoxData<double, OP::numState()> U(layout, OP::ghost());
+        U.initialize(f_eulerState, dx);
+        Benchmark::Work work;
+        work.cells = localCells;
+        work.bytes = localCells*4*2*OP::numState()*sizeof(double);
+        bench.run("Euler::RK4step", work, [&]()
+        {
+            double dt = 0.25*dx;
+            integrator.advance(U, dt);
+        });
+    }
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
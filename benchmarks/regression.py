@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Performance regression check over a Proto benchmark executable.
+
+Runs a benchmark (see Benchmark.H) several times, summarizes the median time of each
+kernel over the runs by its median and dispersion, appends the summary to a JSON
+history file and compares it against a stored baseline. Exits with a nonzero status
+if any kernel is slower than its baseline by more than the tolerance, so that it can
+be used as a CTest test. If the baseline file does not exist it is created from the
+current results.
+
+usage: regression.py [options] -- <command> [arguments]
+e.g.   regression.py --runs 5 --tolerance 0.1 --baseline kernels.json \\
+           --history history.json -- mpirun -np 2 ./BenchmarkKernels -domainSize 64
+"""
+from argparse import ArgumentParser
+import datetime
+import json
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+
+# fields of a benchmark record which must match for two results to be comparable
+CONFIG_FIELDS = ['dim', 'ranks', 'threads', 'domainSize', 'boxSize']
+
+def run_benchmark(command, runs):
+    """Returns {kernel: {'config': {...}, 'samples': [median time of each run]}}"""
+    results = {}
+    for ii in range(runs):
+        with tempfile.TemporaryDirectory() as tmp:
+            output = os.path.join(tmp, 'results.jsonl')
+            status = subprocess.call(command + ['-output', output], stdout=subprocess.DEVNULL)
+            if status != 0:
+                sys.exit('regression.py | Error: "%s" exited with status %d' % (' '.join(command), status))
+            if not os.path.exists(output):
+                sys.exit('regression.py | Error: "%s" wrote no results' % ' '.join(command))
+            with open(output) as f:
+                for line in f:
+                    record = json.loads(line)
+                    kernel = results.setdefault(record['kernel'],
+                            {'config': {key: record[key] for key in CONFIG_FIELDS}, 'samples': []})
+                    kernel['samples'].append(record['time']['median'])
+    return results
+
+def summarize(results):
+    summary = {}
+    for name, kernel in results.items():
+        samples = kernel['samples']
+        median = statistics.median(samples)
+        mad = statistics.median([abs(s - median) for s in samples])
+        summary[name] = {'config': kernel['config'], 'median': median, 'mad': mad,
+                'min': min(samples), 'max': max(samples), 'samples': samples}
+    return summary
+
+def git_revision(source_dir):
+    try:
+        return subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=source_dir,
+                stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+def read_json(filename, default):
+    if not os.path.exists(filename):
+        return default
+    with open(filename) as f:
+        return json.load(f)
+
+def write_json(filename, data):
+    directory = os.path.dirname(os.path.abspath(filename))
+    os.makedirs(directory, exist_ok=True)
+    with open(filename, 'w') as f:
+        json.dump(data, f, indent=1)
+
+def parse_tolerances(entries):
+    tolerances = {}
+    for entry in entries:
+        name, _, value = entry.rpartition('=')
+        if not name:
+            sys.exit('regression.py | Error: --kernel-tolerance expects <kernel>=<tolerance>, got "%s"' % entry)
+        tolerances[name] = float(value)
+    return tolerances
+
+def main():
+    if '--' not in sys.argv:
+        sys.exit(__doc__)
+    split = sys.argv.index('--')
+    command = sys.argv[split+1:]
+    parser = ArgumentParser(usage='regression.py [options] -- <command> [arguments]')
+    parser.add_argument('--runs', type=int, default=5, help='number of runs of the benchmark [5]')
+    parser.add_argument('--tolerance', type=float, default=0.1,
+            help='relative slow down of the median time at which a kernel fails [0.1]')
+    parser.add_argument('--kernel-tolerance', action='append', default=[], metavar='KERNEL=TOL',
+            help='tolerance of a single kernel; may be repeated')
+    parser.add_argument('--baseline', required=True, help='baseline file, created if missing')
+    parser.add_argument('--history', help='history file to which the results are appended')
+    parser.add_argument('--update-baseline', action='store_true',
+            help='replace the baseline by the current results')
+    parser.add_argument('--source-dir', default=os.path.dirname(os.path.abspath(__file__)),
+            help='Proto source directory, used to record the git revision')
+    args = parser.parse_args(sys.argv[1:split])
+    if not command or args.runs < 1:
+        sys.exit(__doc__)
+    tolerances = parse_tolerances(args.kernel_tolerance)
+
+    summary = summarize(run_benchmark(command, args.runs))
+    entry = {'date': datetime.datetime.now(datetime.timezone.utc).isoformat(timespec='seconds'),
+            'host': platform.node(), 'revision': git_revision(args.source_dir),
+            'command': ' '.join(command), 'runs': args.runs, 'kernels': summary}
+    if args.history:
+        history = read_json(args.history, {'entries': []})
+        history['entries'].append(entry)
+        write_json(args.history, history)
+
+    if args.update_baseline or not os.path.exists(args.baseline):
+        write_json(args.baseline, entry)
+        print('Wrote baseline %s with %d kernels' % (args.baseline, len(summary)))
+        return 0
+
+    baseline = read_json(args.baseline, {})['kernels']
+    failures = []
+    print('%-36s %12s %12s %8s %8s  %s' % ('kernel', 'baseline', 'median', 'ratio', 'mad', 'status'))
+    for name, current in sorted(summary.items()):
+        reference = baseline.get(name)
+        if reference is None:
+            status = 'new'
+        elif reference['config'] != current['config']:
+            status = 'skipped (configuration differs from baseline)'
+        else:
+            ratio = current['median'] / reference['median']
+            tolerance = tolerances.get(name, args.tolerance)
+            status = 'ok'
+            if ratio > 1 + tolerance:
+                status = 'FAILED (tolerance %g)' % tolerance
+                failures.append(name)
+            print('%-36s %12.5g %12.5g %8.3f %8.2g  %s' % (name, reference['median'],
+                current['median'], ratio, current['mad'], status))
+            continue
+        print('%-36s %12s %12.5g %8s %8.2g  %s' % (name, '-', current['median'], '-',
+            current['mad'], status))
+    for name in sorted(set(baseline) - set(summary)):
+        print('%-36s missing from the results' % name)
+    if failures:
+        print('Performance regression in: ' + ', '.join(failures))
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
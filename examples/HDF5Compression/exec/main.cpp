@@ -0,0 +1,130 @@
+#include "Proto.H"
+#include "InputParser.H"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+using namespace Proto;
+using namespace std;
+
+// Smooth data with a few superimposed modes; typical of a plot file variable
+PROTO_KERNEL_START
+void f_waveF(Point& a_pt, Var<double, 2>& a_U, double a_dx)
+{
+    double x[DIM];
+    for (int dir = 0; dir < DIM; dir++) { x[dir] = a_pt[dir]*a_dx + a_dx/2.0; }
+    double phi = 1.0;
+    double psi = 0.0;
+    for (int dir = 0; dir < DIM; dir++)
+    {
+        phi *= sin(2*M_PI*x[dir]);
+        psi += cos(2*M_PI*(dir + 1)*x[dir]);
+    }
+    a_U(0) = 1.0 + 0.1*phi;
+    a_U(1) = psi;
+}
+PROTO_KERNEL_END(f_waveF, f_wave)
+
+struct Setting
+{
+    std::string name;
+    bool chunking;
+    int deflate;
+    bool shuffle;
+    int digits;
+};
+
+size_t fileSize(std::string a_filename)
+{
+    std::ifstream file(a_filename, std::ios::binary | std::ios::ate);
+    return file.tellg();
+}
+
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    // DEFAULT PARAMETERS
+    int domainSize = 128;
+    int boxSize = 32;
+    int numIter = 3;
+    int digits = 6;
+
+    // PARSE COMMAND LINE
+    InputArgs args;
+    args.add("domainSize", domainSize);
+    args.add("boxSize",    boxSize);
+    args.add("numIter",    numIter);
+    args.add("digits",     digits);
+    args.parse(argc, argv);
+    args.print();
+
+    double dx = 1.0 / domainSize;
+
+    // INITIALIZE DATA
+    auto domain = Box::Cube(domainSize);
+    array<bool,DIM> per;
+    per.fill(true);
+    ProblemDomain pd(domain,per);
+    DisjointBoxLayout layout(pd,Point::Ones(boxSize));
+    LevelBoxData<double, 2> U(layout, Point::Zeros());
+    for (auto iter : layout)
+    {
+        forallInPlace_p(f_wave, U[iter], dx);
+    }
+    double dataSize = (double)domain.size()*2*sizeof(double);
+
+    std::vector<Setting> settings = {
+        {"contiguous",          false, 0, false, -1},
+        {"chunked",             true,  0, false, -1},
+        {"deflate1",            true,  1, false, -1},
+        {"shuffle+deflate1",    true,  1, true,  -1},
+        {"shuffle+deflate6",    true,  6, true,  -1},
+        {"quantize+deflate1",   true,  1, true,  digits},
+        {"quantize+deflate6",   true,  6, true,  digits}};
+
+    if (procID() == 0)
+    {
+        std::cout << std::setfill(' ') << std::setw(20) << std::left << "setting"
+            << std::setw(14) << std::right << "time (s)"
+            << std::setw(14) << "MB/s"
+            << std::setw(14) << "file (MB)"
+            << std::setw(14) << "ratio" << std::endl;
+    }
+    for (auto& setting : settings)
+    {
+        HDF5Handler h5;
+        h5.setChunking(setting.chunking);
+        h5.setCompression(setting.deflate, setting.shuffle);
+        h5.setQuantization(setting.digits);
+        std::string filename = "COMPRESSION_" + setting.name + ".hdf5";
+        double minTime = 1e30;
+        for (int ii = 0; ii < numIter; ii++)
+        {
+#ifdef PR_MPI
+            barrier();
+#endif
+            auto start = std::chrono::steady_clock::now();
+            h5.writeLevel(dx, U, filename);
+#ifdef PR_MPI
+            barrier();
+#endif
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            minTime = std::min(minTime, elapsed.count());
+        }
+        if (procID() == 0)
+        {
+            double size = fileSize(filename);
+            std::cout << std::setw(20) << std::left << setting.name
+                << std::setw(14) << std::right << std::setprecision(4) << minTime
+                << std::setw(14) << dataSize/minTime/1e6
+                << std::setw(14) << size/1e6
+                << std::setw(14) << dataSize/size << std::endl;
+        }
+    }
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
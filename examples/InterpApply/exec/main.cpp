@@ -0,0 +1,88 @@
+#include "Proto.H"
+#include "InputParser.H"
+#include <chrono>
+#include <iomanip>
+
+using namespace Proto;
+
+// Benchmark of InterpStencil::apply for the 4th and 5th order FiniteVolume interpolants.
+// Compares the fused tensor product kernel used by apply, which computes all of the fine
+// cells of a coarse cell at once, to applyStaged, which refines the data one direction at
+// a time through DIM temporary BoxData. Reports the time per fine cell of each version
+// and the difference between their outputs.
+template<typename Func>
+double timeApply(int a_numIter, Func&& a_func)
+{
+    a_func();
+    double minTime = 1e30;
+    for (int ii = 0; ii < a_numIter; ii++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        a_func();
+#ifdef PROTO_ACCEL
+        protoDeviceSynchronizeGPU();
+#endif
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        minTime = std::min(minTime, elapsed.count());
+    }
+    return minTime;
+}
+
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    // DEFAULT PARAMETERS
+    int boxSize = 32;
+    int refRatio = 2;
+    int numIter = 10;
+
+    // PARSE COMMAND LINE
+    InputArgs args;
+    args.add("boxSize",  boxSize);
+    args.add("refRatio", refRatio);
+    args.add("numIter",  numIter);
+    args.parse(argc, argv);
+    args.print();
+
+    constexpr unsigned int C = 5;
+    Box crseBox = Box::Cube(boxSize);
+    Box fineBox = crseBox.refine(refRatio);
+    BoxData<double, C> src(crseBox.grow(2));
+    BoxData<double, C> fused(fineBox);
+    BoxData<double, C> staged(fineBox);
+    forallInPlace_p(
+        [] PROTO_LAMBDA (Point& a_pt, Var<double, C>& a_data)
+        {
+            for (int cc = 0; cc < C; cc++)
+            {
+                a_data(cc) = 1.0;
+                for (int dir = 0; dir < DIM; dir++)
+                {
+                    a_data(cc) *= sin(0.1*(cc + 1)*a_pt[dir]);
+                }
+            }
+        }, src);
+
+    for (int order = 4; order <= 5; order++)
+    {
+        auto I = InterpStencil<double>::FiniteVolume(Point::Ones(refRatio), order);
+        double fusedTime = timeApply(numIter, [&](){ fused |= I(src); });
+        double stagedTime = timeApply(numIter, [&](){ I.applyStaged(staged, src, Box(), true); });
+        fused -= staged;
+        if (procID() == 0)
+        {
+            std::cout << std::setprecision(4)
+                << "order " << order << " | fine cells: " << fineBox.size()
+                << " | components: " << C << std::endl;
+            std::cout << "    fused:  " << fusedTime / fineBox.size() * 1e9 << " ns / cell" << std::endl;
+            std::cout << "    staged: " << stagedTime / fineBox.size() * 1e9 << " ns / cell"
+                << " | speedup: " << stagedTime / fusedTime << std::endl;
+            std::cout << "    max difference: " << fused.absMax() << std::endl;
+        }
+    }
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
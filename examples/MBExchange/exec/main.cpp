@@ -0,0 +1,134 @@
+#include "Proto.H"
+#include "InputParser.H"
+#include "MBLevelMap_CubeSphereShell.H"
+#include <chrono>
+#include <iomanip>
+
+using namespace Proto;
+
+// Benchmark of the multiblock ghost cell exchange on the cubed-sphere shell.
+// Reports the time of MBLevelBoxData::exchange per ghost cell filled across block
+// boundaries. The result is checked against MBBoundaryData::fill, which copies the
+// source region into a temporary and rotates it in a second pass.
+int main(int argc, char** argv)
+{
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+#if DIM == 3
+    // DEFAULT PARAMETERS
+    int domainSize = 64;
+    int boxSize = 32;
+    int thickness = 16;
+    int numGhost = 3;
+    int numIter = 20;
+
+    // PARSE COMMAND LINE
+    InputArgs args;
+    args.add("domainSize", domainSize);
+    args.add("boxSize",    boxSize);
+    args.add("thickness",  thickness);
+    args.add("numGhost",   numGhost);
+    args.add("numIter",    numIter);
+    args.parse(argc, argv);
+    args.print();
+
+    int radialDir = CUBE_SPHERE_SHELL_RADIAL_COORD;
+    auto domain = buildCubeSphereShell(domainSize, thickness, radialDir);
+    Point boxSizeVect = Point::Ones(boxSize);
+    boxSizeVect[radialDir] = thickness;
+    MBDisjointBoxLayout layout(domain, boxSizeVect);
+
+    Array<Point, DIM+1> ghost;
+    ghost.fill(Point::Ones(numGhost));
+    ghost[0][radialDir] = 0;
+
+    // INITIALIZE DATA WITH THE MAPPED COORDINATES
+    MBLevelMap_CubeSphereShell<HOST> map;
+    map.define(layout, ghost);
+    MBLevelBoxData<double, DIM, HOST> data(layout, ghost);
+    for (auto iter : layout)
+    {
+        auto block = layout.block(iter);
+        auto X = map.cellCentered(layout[iter], block, block);
+        data[iter].setVal(0);
+        X.copyTo(data[iter]);
+    }
+
+    // COUNT BLOCK BOUNDARY GHOST CELLS
+    long int numGhostCells = 0;
+    for (auto iter : layout)
+    {
+        for (auto dir : Box::Kernel(1))
+        {
+            for (auto& bound : data.bounds(iter, dir))
+            {
+                numGhostCells += bound.localData->box().size();
+            }
+        }
+    }
+#ifdef PR_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &numGhostCells, 1, MPI_LONG, MPI_SUM, Proto_MPI<void>::comm);
+#endif
+
+    // TIME THE EXCHANGE
+    data.exchange();
+    double minTime = 1e30;
+    double totalTime = 0;
+    for (int ii = 0; ii < numIter; ii++)
+    {
+#ifdef PR_MPI
+        barrier();
+#endif
+        auto start = std::chrono::steady_clock::now();
+        data.exchange();
+#ifdef PR_MPI
+        barrier();
+#endif
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        minTime = std::min(minTime, elapsed.count());
+        totalTime += elapsed.count();
+    }
+
+    // CHECK AGAINST THE TWO-PASS COPY FOR LOCAL BOUNDARIES
+    double maxError = 0;
+    for (auto iter : layout)
+    {
+        for (auto dir : Box::Kernel(1))
+        {
+            for (auto& bound : data.bounds(iter, dir))
+            {
+                if (layout.procID(bound.adjIndex) != procID()) { continue; }
+                BoxData<double, DIM, HOST> exchanged(bound.localData->box());
+                bound.localData->copyTo(exchanged);
+                bound.fill(data[bound.adjIndex]);
+                exchanged -= *bound.localData;
+                maxError = std::max(maxError, exchanged.absMax());
+            }
+        }
+    }
+#ifdef PR_MPI
+    MPI_Allreduce(MPI_IN_PLACE, &maxError, 1, MPI_DOUBLE, MPI_MAX, Proto_MPI<void>::comm);
+#endif
+
+    if (procID() == 0)
+    {
+        std::cout << "boxes: " << layout.numBoxes()
+            << " | block boundary ghost cells: " << numGhostCells
+            << " | components: " << DIM << std::endl;
+        std::cout << std::setprecision(4)
+            << "exchange time (s):  min " << minTime
+            << " | mean " << totalTime / numIter << std::endl;
+        std::cout << "time per ghost cell (ns): " << minTime / numGhostCells * 1e9 << std::endl;
+        std::cout << "max difference from two-pass copy: " << maxError << std::endl;
+    }
+#else
+    if (procID() == 0)
+    {
+        std::cout << "MBExchange requires DIM = 3" << std::endl;
+    }
+#endif
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+}
@@ -214,6 +214,33 @@ void f_advectionExactF(
 }
 PROTO_KERNEL_END(f_advectionExactF, f_advectionExact);
 
+TEST(AMRData, Checkpoint)
+{
+    int domainSize = 32;
+    int numLevels = 3;
+    Point offset(1,2,3,4,5,6);
+    Point k(1,2,3,4,5,6);
+    double dx = 1.0/domainSize;
+    Point refRatio = Point::Ones(2);
+    Point boxSize = Point::Ones(16);
+    auto grid = telescopingGrid(domainSize, numLevels, refRatio, boxSize);
+    AMRData<double, 1, HOST> writeData(grid, Point::Ones());
+    writeData.initialize(dx, f_phi, k, offset);
+    CheckpointHandler chk;
+    chk.write(writeData, "AMR_DATA_CHK");
+
+    AMRData<double, 1, HOST> readData(grid, Point::Ones());
+    readData.setToZero();
+    chk.read(readData, "AMR_DATA_CHK");
+    for (int lvl = 0; lvl < numLevels; lvl++)
+    {
+        for (auto iter : grid[lvl])
+        {
+            EXPECT_TRUE(compareBoxData(writeData[lvl][iter], readData[lvl][iter]));
+        }
+    }
+}
+
 TEST(AMRData, CopyToRefinement)
 {
 constexpr int TIME_STEP = 0;
@@ -327,6 +327,55 @@ TEST(CoordPermutation, RotateBuffer)
     }
 }
 
+TEST(CoordPermutation, RotateBufferAllPermutations)
+{
+    // boxes are larger than the tiles used by the host implementation
+    // all permutations and reflections of the first three coordinates are tested
+    constexpr unsigned int C = 2;
+    constexpr int numCoords = DIM < 3 ? DIM : 3;
+    Box B0 = Box(Point(37,45,5,1,1,1)).shift(Point(1,-2,3,-4,5,-6));
+    BoxData<int, C, HOST> src(B0);
+    forallInPlace_p(f_pointID, src);
+    BoxData<int, C, HOST> srcGrown(B0.grow(3));
+    forallInPlace_p(f_pointID, srcGrown);
+    std::array<int, DIM> perm;
+    for (int dir = 0; dir < DIM; dir++) { perm[dir] = dir; }
+    do {
+        for (int signs = 0; signs < (1 << numCoords); signs++)
+        {
+            Array<Array<int, DIM>, DIM> matrix;
+            for (int dir = 0; dir < DIM; dir++)
+            {
+                matrix[dir].fill(0);
+                matrix[dir][perm[dir]] = (signs & (1 << dir)) ? -1 : 1;
+            }
+            CoordPermutation R;
+            R.defineMatrix(matrix);
+            Box B1 = Box(R(B0.sizes()).abs()).shift(Point::Ones());
+            BoxData<int, C, HOST> dst(B1);
+            dst.setVal(-1);
+            src.copyTo(dst, R);
+            BoxData<int, C, HOST> dstRegion(B1);
+            dstRegion.setVal(-1);
+            srcGrown.copyTo(dstRegion, B0, R);
+            BoxData<int, C, HOST> rotated(B0);
+            src.copyTo(rotated);
+            rotated.rotate(B1, R);
+            EXPECT_EQ(rotated.box(), B1);
+            for (int cc = 0; cc < C; cc++)
+            {
+                for (auto pi : B0)
+                {
+                    auto pj = R.rotateCell(pi, B0, B1);
+                    EXPECT_EQ(src(pi, cc), dst(pj, cc));
+                    EXPECT_EQ(src(pi, cc), rotated(pj, cc));
+                    EXPECT_EQ(src(pi, cc), dstRegion(pj, cc));
+                }
+            }
+        }
+    } while (std::next_permutation(perm.begin(), perm.begin() + numCoords));
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 #ifdef PR_MPI
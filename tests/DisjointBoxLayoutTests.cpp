@@ -196,6 +196,39 @@ TEST(DisjointBoxLayout, Contains) {
         }
     }
 }
+
+TEST(DisjointBoxLayout, ParallelForEach) {
+    int domainSize = 64;
+    int boxSize = 8;
+    Box domainBox = Box::Cube(domainSize);
+    Point boxSizeVect = Point::Ones(boxSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(true);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout layout(domain, boxSizeVect);
+
+    auto& pool = ThreadPool::getPool();
+    unsigned int numThreads = pool.numThreads();
+    for (unsigned int nt : {1, 4})
+    {
+        pool.setNumThreads(nt);
+        EXPECT_EQ(pool.numThreads(), nt);
+        std::vector<std::atomic<int>> visits(layout.localSize());
+        for (auto& v : visits) { v = 0; }
+        layout.parallelForEach([&](const LevelIndex& a_index)
+        {
+            EXPECT_EQ(layout.procID(a_index), procID());
+            visits[a_index.local()]++;
+            // nested calls run serially on the calling thread
+            unsigned int nested = 0;
+            layout.parallelForEach([&](const LevelIndex&) { nested++; });
+            EXPECT_EQ(nested, layout.localSize());
+        });
+        for (auto& v : visits) { EXPECT_EQ(v, 1); }
+    }
+    pool.setNumThreads(numThreads);
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 #ifdef PR_MPI
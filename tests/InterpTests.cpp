@@ -319,6 +319,67 @@ TEST(InterpStencil, FiniteVolume) {
         EXPECT_GT(rate5, 5 - 0.01);
     }
 }
+TEST(InterpStencil, FusedApply) {
+    constexpr unsigned int C = 3;
+    constexpr unsigned char D = 1;
+
+    int domainSize = 8;
+    Array<double, DIM> k{1,2,3,4,5,6};
+    Array<double, DIM> offset{1,2,3,4,5,6};
+    offset *= (0.1);
+    Array<double, DIM> cdx(1.0/domainSize);
+
+    Box srcBox = Box::Cube(domainSize).grow(2);
+    BoxData<double, C, HOST, D> srcData(srcBox);
+    forallInPlace_p(f_phi_avg, srcData, cdx, k, offset);
+    // source data which does not cover the full footprint of the high boundary cells
+    Box cutBox(srcBox.low(), srcBox.high() - Point::Ones());
+    BoxData<double, C, HOST, D> cutData(cutBox);
+    srcData.copyTo(cutData);
+
+    std::vector<Point> ratios{Point::Ones(2), Point::Ones(4), Point(2,4,2,4,2,4)};
+    for (auto refRatio : ratios)
+    {
+        std::vector<InterpStencil<double>> stencils;
+        stencils.push_back(InterpStencil<double>::Constant(refRatio));
+        stencils.push_back(InterpStencil<double>::Linear(refRatio));
+        stencils.push_back(InterpStencil<double>::Quadratic(refRatio));
+        for (int order = 2; order <= 5; order++)
+        {
+            stencils.push_back(InterpStencil<double>::FiniteVolume(refRatio, order));
+        }
+        Box dstBox = Box::Cube(domainSize).refine(refRatio);
+        // a range which does not align with the coarse cells
+        Box subBox = dstBox.grow(-3).shift(Point::Basis(0));
+        Box validBox = Box::Cube(domainSize - 1).refine(refRatio);
+        for (auto& I : stencils)
+        {
+            BoxData<double, C, HOST, D> fused(dstBox);
+            BoxData<double, C, HOST, D> staged(dstBox);
+            BoxData<double, C, HOST, D> partial(dstBox);
+            fused.setVal(7);
+            staged.setVal(7);
+            partial.setVal(7);
+            I.apply(fused, srcData, dstBox, true, 0.5);
+            I.applyStaged(staged, srcData, dstBox, true, 0.5);
+            I.apply(partial, cutData, dstBox, true, 0.5);
+            // cells with a partial footprint are skipped
+            double error = 0;
+            for (auto pt : dstBox)
+            {
+                if (validBox.contains(pt)) { EXPECT_NE(partial(pt), 7); }
+                if (partial(pt) == 7) { continue; }
+                error = std::max(error, std::abs(partial(pt) - staged(pt)));
+            }
+            EXPECT_LT(error, 1e-12);
+
+            I.apply(fused, srcData, subBox, false, 2.0);
+            I.applyStaged(staged, srcData, subBox, false, 2.0);
+            fused -= staged;
+            EXPECT_LT(fused.absMax(), 1e-12);
+        }
+    }
+}
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 #ifdef PR_MPI
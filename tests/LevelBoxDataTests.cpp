@@ -123,6 +123,33 @@ TEST(LevelBoxData, SetVal) {
     }
 }
 
+TEST(LevelBoxData, ThreadedBulkOps) {
+    int domainSize = 32;
+    Point boxSize = Point::Ones(8);
+    DisjointBoxLayout layout = testLayout(domainSize, boxSize);
+    auto& pool = ThreadPool::getPool();
+    unsigned int numThreads = pool.numThreads();
+    pool.setNumThreads(4);
+    LevelBoxData<double, 2, HOST> hostData(layout, Point::Ones());
+    LevelBoxData<double, 2, HOST> incrData(layout, Point::Ones());
+    hostData.setVal(1);
+    hostData.setVal(7, 1);
+    incrData.setVal(3);
+    hostData *= 2;
+    hostData += 1;
+    hostData.increment(incrData, 0.5);
+    pool.setNumThreads(numThreads);
+    for (auto iter : layout)
+    {
+        auto& hostData_i = hostData[iter];
+        for (auto pi : hostData_i.box())
+        {
+            EXPECT_EQ(hostData_i(pi, 0), 4.5);
+            EXPECT_EQ(hostData_i(pi, 1), 16.5);
+        }
+    }
+}
+
 TEST(LevelBoxData, Iota) {
     int domainSize = 32;
     Point boxSize = Point::Ones(16);
@@ -297,6 +324,28 @@ TEST(LevelBoxData, LinearSize)
     EXPECT_EQ(srcSize*sizeof(double), src.linearSize());
 
 }
+TEST(LevelBoxData, MemoryUsage)
+{
+    int domainSize = 32;
+    Point boxSize = Point::Ones(16);
+    auto layout = testLayout(domainSize, boxSize);
+    long long int levelData = MemoryUsage::current(MemoryUsage::LEVEL_DATA, HOST);
+    long long int temporary = MemoryUsage::current(MemoryUsage::TEMPORARY, HOST);
+    {
+        LevelBoxData<double, 2, HOST> data(layout, Point::Ones(1));
+        EXPECT_EQ(MemoryUsage::current(MemoryUsage::LEVEL_DATA, HOST),
+                levelData + data.linearSize());
+        EXPECT_GE(MemoryUsage::peak(MemoryUsage::LEVEL_DATA, HOST),
+                levelData + data.linearSize());
+        BoxData<double, 2, HOST> temp(Box::Cube(8));
+        EXPECT_EQ(MemoryUsage::current(MemoryUsage::TEMPORARY, HOST),
+                temporary + temp.linearSize());
+        EXPECT_EQ(MemoryUsage::current(MemoryUsage::LEVEL_DATA, HOST),
+                levelData + data.linearSize());
+    }
+    EXPECT_EQ(MemoryUsage::current(MemoryUsage::LEVEL_DATA, HOST), levelData);
+    EXPECT_EQ(MemoryUsage::current(MemoryUsage::TEMPORARY, HOST), temporary);
+}
 TEST(LevelBoxData, CopyToHostToHost)
 {
     int domainSize = 64;
@@ -430,6 +479,447 @@ TEST(LevelBoxData, ExchangeHost)
     hostData.exchange();
     EXPECT_TRUE(testExchange(hostData));
 }
+TEST(LevelBoxData, ExchangeRepeatedHost)
+{
+    // exchange copiers reuse persistent requests; make sure restarting them is correct
+    constexpr unsigned int C = 2;
+    int domainSize = 64;
+    int ghostSize = 2;
+    Point boxSize = Point::Ones(16);
+    auto layout = testLayout(domainSize, boxSize);
+    LevelBoxData<double, C, HOST> hostData(layout, Point::Ones(ghostSize));
+    for (int ii = 0; ii < 3; ii++)
+    {
+        hostData.setVal(-1);
+        for (auto iter : layout)
+        {
+            auto& hostData_i = hostData[iter];
+            BoxData<double, C, HOST> tmpData(layout[iter]);
+            forallInPlace_p(f_pointID, tmpData);
+            tmpData.copyTo(hostData_i);
+        }
+        hostData.exchange();
+        EXPECT_TRUE(testExchange(hostData));
+    }
+}
+template<typename T, unsigned int C, MemType MEM, Centering CTR>
+class NeighborExchangeCopier : public LevelExchangeCopier<T, C, MEM, CTR>
+{
+    public:
+    NeighborExchangeCopier() { this->setNeighborCollective(true); }
+};
+
+TEST(LevelBoxData, ExchangeNeighborCollectiveHost)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 64;
+    int ghostSize = 2;
+    Point boxSize = Point::Ones(16);
+    auto layout = testLayout(domainSize, boxSize);
+    LevelBoxData<double, C, HOST> hostData(layout, Point::Ones(ghostSize));
+    hostData.defineExchange<NeighborExchangeCopier>();
+    for (int ii = 0; ii < 2; ii++)
+    {
+        hostData.setVal(-1);
+        for (auto iter : layout)
+        {
+            auto& hostData_i = hostData[iter];
+            BoxData<double, C, HOST> tmpData(layout[iter]);
+            forallInPlace_p(f_pointID, tmpData);
+            tmpData.copyTo(hostData_i);
+        }
+        hostData.exchange();
+        EXPECT_TRUE(testExchange(hostData));
+    }
+}
+
+template<typename T, unsigned int C, MemType MEM, Centering CTR>
+class SharedMemoryExchangeCopier : public LevelExchangeCopier<T, C, MEM, CTR>
+{
+    public:
+    SharedMemoryExchangeCopier() { this->setSharedMemory(true); }
+};
+
+TEST(LevelBoxData, ExchangeSharedMemoryHost)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 64;
+    int ghostSize = 2;
+    Point boxSize = Point::Ones(16);
+    auto layout = testLayout(domainSize, boxSize);
+    LevelBoxData<double, C, HOST> hostData(layout, Point::Ones(ghostSize));
+    hostData.defineExchange<SharedMemoryExchangeCopier>();
+    for (int ii = 0; ii < 2; ii++)
+    {
+        hostData.setVal(-1);
+        for (auto iter : layout)
+        {
+            auto& hostData_i = hostData[iter];
+            BoxData<double, C, HOST> tmpData(layout[iter]);
+            forallInPlace_p(f_pointID, tmpData);
+            tmpData.copyTo(hostData_i);
+        }
+        hostData.exchange();
+        EXPECT_TRUE(testExchange(hostData));
+    }
+}
+TEST(LevelBoxData, RepartitionHost)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 64;
+    int ghostSize = 1;
+    Point boxSize = Point::Ones(16);
+    auto layout = testLayout(domainSize, boxSize);
+    LevelBoxData<double, C, HOST> hostData(layout, Point::Ones(ghostSize));
+    hostData.initialize(f_pointID);
+
+    // assign the patches to the processes in reverse order with an uneven load
+    std::vector<Point> patches;
+    for (auto item : layout.boxes()) { patches.push_back(item.first); }
+    DisjointBoxLayout newLayout(layout.domain(), patches, boxSize);
+    std::vector<std::pair<int, unsigned int>> assignment;
+    unsigned int numAssigned = 0;
+    for (int proc = numProc()-1; proc >= 0; proc--)
+    {
+        unsigned int numBoxes = (proc == 0) ? patches.size() - numAssigned
+                                            : (patches.size() / numProc()) / 2;
+        assignment.push_back(std::make_pair(proc, numBoxes));
+        numAssigned += numBoxes;
+    }
+    newLayout.loadAssign(assignment);
+
+    hostData.repartition(newLayout);
+    EXPECT_TRUE(hostData.layout().compatible(newLayout));
+    // a process may own no patches after repartitioning
+    size_t linearSize = 0;
+    for (auto iter : newLayout)
+    {
+        linearSize += hostData[iter].linearSize();
+    }
+    EXPECT_EQ(hostData.linearSize(), linearSize);
+    for (auto iter : newLayout)
+    {
+        auto& hostData_i = hostData[iter];
+        EXPECT_EQ(hostData_i.box(), newLayout[iter].grow(ghostSize));
+        BoxData<double, C, HOST> soln_i(hostData_i.box());
+        forallInPlace_p(f_pointID, soln_i);
+        EXPECT_TRUE(compareBoxData(soln_i, hostData_i));
+    }
+    hostData.setToZero();
+    for (auto iter : newLayout)
+    {
+        auto& hostData_i = hostData[iter];
+        BoxData<double, C, HOST> tmpData(newLayout[iter]);
+        forallInPlace_p(f_pointID, tmpData);
+        tmpData.copyTo(hostData_i);
+    }
+    hostData.exchange();
+    EXPECT_TRUE(testExchange(hostData));
+}
+
+TEST(LevelBoxData, CheckpointHost)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Point boxSize = Point::Ones(8);
+    auto layout = testLayout(domainSize, boxSize);
+    LevelBoxData<double, C, HOST> writeData(layout, Point::Ones(2));
+    writeData.initialize(f_pointID);
+    CheckpointHandler chk;
+    chk.setTime(1.5);
+    chk.setTimestep(0.25);
+    chk.write(writeData, "LEVEL_BOX_DATA_CHK_%i", 7);
+
+    LevelBoxData<double, C, HOST> readData(layout, Point::Ones(2));
+    readData.setVal(0);
+    CheckpointHandler restart;
+    restart.read(readData, "LEVEL_BOX_DATA_CHK_%i", 7);
+    EXPECT_EQ(restart.time(), 1.5);
+    EXPECT_EQ(restart.dt(), 0.25);
+    for (auto iter : layout)
+    {
+        EXPECT_TRUE(compareBoxData(writeData[iter], readData[iter]));
+    }
+
+    // a single changed bit changes the checksum
+    auto& data_0 = writeData[*layout.begin()];
+    uint64_t checksum = CheckpointHandler::checksum(data_0.data(), data_0.linearSize());
+    data_0.data()[17] = std::nextafter(data_0.data()[17], 1e10);
+    EXPECT_NE(checksum, CheckpointHandler::checksum(data_0.data(), data_0.linearSize()));
+}
+
+#ifdef PR_HDF5
+TEST(LevelBoxData, WriteReadHDF5)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 64;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(false);
+    ProblemDomain domain(domainBox, periodicity);
+    HDF5Handler h5;
+    h5.setCollective(true);
+    h5.setHint("romio_cb_write", "enable");
+    for (int boxSize : {8, 16})
+    {
+        DisjointBoxLayout layout(domain, Point::Ones(boxSize));
+        LevelBoxData<double, C, HOST> writeData(layout, Point::Ones(2));
+        for (auto iter : layout)
+        {
+            forallInPlace_p(f_pointID, writeData[iter]);
+        }
+        h5.writeLevel(writeData, "LEVEL_BOX_DATA_IO");
+        LevelBoxData<double, C, HOST> readData(layout, Point::Ones(2));
+        readData.setVal(0);
+        h5.readLevel(readData, "LEVEL_BOX_DATA_IO");
+        EXPECT_EQ(readData.ghost(), writeData.ghost());
+        for (auto iter : readData.layout())
+        {
+            auto& readData_i = readData[iter];
+            BoxData<double, C, HOST> soln_i(readData_i.box());
+            forallInPlace_p(f_pointID, soln_i);
+            EXPECT_TRUE(compareBoxData(soln_i, readData_i));
+        }
+    }
+}
+
+TEST(LevelBoxData, ReadHDF5Redistribute)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(true);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout writeLayout(domain, Point::Ones(16));
+    LevelBoxData<double, C, HOST> writeData(writeLayout, Point::Ones(2));
+    for (auto iter : writeLayout)
+    {
+        forallInPlace_p(f_pointID, writeData[iter]);
+    }
+    writeData.exchange();
+    HDF5Handler h5;
+    h5.setCollective(true);
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_RESTART");
+    for (auto boxSize : {Point::Ones(8), Point(16, 8, 4, 2, 1, 1)})
+    {
+        DisjointBoxLayout readLayout(domain, boxSize);
+        LevelBoxData<double, C, HOST> readData;
+        h5.readLevel(readData, readLayout, Point::Ones(1), "LEVEL_BOX_DATA_RESTART");
+        EXPECT_EQ(readData.ghost(), Point::Ones(1));
+        // only valid data is read onto a different layout
+        readData.exchange();
+        LevelBoxData<double, C, HOST> solnData(readLayout, Point::Ones(1));
+        for (auto iter : readLayout)
+        {
+            forallInPlace_p(f_pointID, solnData[iter]);
+        }
+        solnData.exchange();
+        EXPECT_TRUE(compareLevelData(solnData, readData));
+        for (auto iter : readLayout)
+        {
+            EXPECT_TRUE(compareBoxData(solnData[iter], readData[iter]));
+        }
+    }
+}
+
+TEST(LevelBoxData, ReadHDF5StoredGhost)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(true);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout layout(domain, Point::Ones(8));
+    // the stored ghost cells differ from the valid data of the neighbors
+    LevelBoxData<double, C, HOST> writeData(layout, Point::Ones(2));
+    writeData.setVal(-7);
+    for (auto iter : layout)
+    {
+        BoxData<double, C, HOST> valid(layout[iter]);
+        forallInPlace_p(f_pointID, valid);
+        valid.copyTo(writeData[iter]);
+    }
+    HDF5Handler h5;
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_GHOST");
+
+    LevelBoxData<double, C, HOST> readData;
+    h5.readLevel(readData, "LEVEL_BOX_DATA_GHOST");
+    for (auto iter : readData.layout())
+    {
+        EXPECT_TRUE(compareBoxData(writeData[iter], readData[iter]));
+    }
+
+    // same layout, fewer ghost cells than stored
+    h5.readLevel(readData, layout, Point::Ones(1), "LEVEL_BOX_DATA_GHOST");
+    for (auto iter : layout)
+    {
+        BoxData<double, C, HOST> soln_i(readData[iter].box());
+        writeData[iter].copyTo(soln_i);
+        EXPECT_TRUE(compareBoxData(soln_i, readData[iter]));
+    }
+}
+
+TEST(LevelBoxData, WriteReadHDF5Compressed)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(false);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout layout(domain, Point::Ones(8));
+    Array<double, DIM> dx, k, offset;
+    dx.fill(1.0/domainSize);
+    k.fill(1.0);
+    offset.fill(0.0);
+    LevelBoxData<double, C, HOST> writeData(layout, Point::Ones(1));
+    for (auto iter : layout)
+    {
+        forallInPlace_p(f_phi, writeData[iter], dx, k, offset);
+    }
+    HDF5Handler h5;
+    h5.setCompression(6);
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_DEFLATE");
+    h5.setQuantization(4);
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_QUANTIZE");
+
+    LevelBoxData<double, C, HOST> readData(layout, Point::Ones(1));
+    readData.setVal(0);
+    h5.readLevel(readData, "LEVEL_BOX_DATA_DEFLATE");
+    EXPECT_TRUE(compareLevelData(writeData, readData));
+    
+    readData.setVal(0);
+    h5.readLevel(readData, "LEVEL_BOX_DATA_QUANTIZE");
+    for (auto iter : layout)
+    {
+        BoxData<double, C, HOST> error(layout[iter]);
+        writeData[iter].copyTo(error);
+        error -= readData[iter];
+        EXPECT_LE(error.absMax(), 0.5e-4);
+    }
+}
+
+TEST(LevelBoxData, WriteHDF5Async)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(false);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout layout(domain, Point::Ones(8));
+    LevelBoxData<double, C, HOST> data(layout, Point::Ones(1));
+    HDF5Handler h5;
+    h5.setAsync(true);
+    // three writes in a row exercise reuse of the two snapshot buffers
+    for (int ii = 0; ii < 3; ii++)
+    {
+        data.setVal(ii);
+        h5.writeLevel(data, "LEVEL_BOX_DATA_ASYNC_%i", ii);
+    }
+    // changing the data must not affect output which is still pending
+    data.setVal(-1);
+    h5.wait();
+    h5.setAsync(false);
+    for (int ii = 0; ii < 3; ii++)
+    {
+        LevelBoxData<double, C, HOST> readData(layout, Point::Ones(1));
+        readData.setVal(-1);
+        h5.readLevel(readData, "LEVEL_BOX_DATA_ASYNC_%i", ii);
+        for (auto iter : layout)
+        {
+            BoxData<double, C, HOST> soln_i(readData[iter].box());
+            soln_i.setVal(ii);
+            EXPECT_TRUE(compareBoxData(soln_i, readData[iter]));
+        }
+    }
+}
+
+TEST(LevelBoxData, WriteHDF5Reduced)
+{
+    constexpr unsigned int C = 2;
+    int domainSize = 32;
+    Box domainBox = Box::Cube(domainSize);
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(false);
+    ProblemDomain domain(domainBox, periodicity);
+    DisjointBoxLayout layout(domain, Point::Ones(8));
+    Array<double, DIM> dx, k, offset;
+    dx.fill(1.0/domainSize);
+    k.fill(1.0);
+    offset.fill(0.0);
+    LevelBoxData<double, C, HOST> writeData(layout, Point::Ones(1));
+    for (auto iter : layout)
+    {
+        forallInPlace_p(f_phi, writeData[iter], dx, k, offset);
+    }
+
+    // coarsened single component
+    HDF5Handler h5;
+    Point refRatio = Point::Ones(2);
+    h5.setCoarsening(refRatio);
+    h5.setComponents({1});
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_COARSE");
+    auto crseLayout = layout.coarsen(refRatio);
+    LevelBoxData<double, C, HOST> crseData(crseLayout, Point::Zeros());
+    writeData.coarsenTo(crseData, refRatio);
+    LevelBoxData<double, 1, HOST> readCrse;
+    h5.readLevel(readCrse, crseLayout, Point::Zeros(), "LEVEL_BOX_DATA_COARSE");
+    for (auto iter : crseLayout)
+    {
+        auto soln_i = slice(crseData[iter], 1);
+        EXPECT_TRUE(compareBoxData(soln_i, readCrse[iter]));
+    }
+
+    // slice of all components
+    h5.setCoarsening(Point::Ones());
+    h5.setComponents({});
+    Box region = domainBox.edge(Point::Basis(0, -1)).shift(0, 13);
+    h5.setRegion(region);
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_SLICE");
+    LevelBoxData<double, C, HOST> readSlice;
+    h5.readLevel(readSlice, layout, Point::Zeros(), "LEVEL_BOX_DATA_SLICE");
+    for (auto iter : layout)
+    {
+        Box sliceBox = layout[iter] & region;
+        if (sliceBox.empty()) { continue; }
+        BoxData<double, C, HOST> slice_i(sliceBox);
+        readSlice[iter].copyTo(slice_i);
+        EXPECT_TRUE(compareBoxData(writeData[iter], slice_i));
+    }
+
+    // compressed region which clips the patches to different sizes
+    region = Box(Point::Ones(3), Point::Ones(20));
+    h5.setRegion(region);
+    h5.setCompression(6);
+    h5.writeLevel(writeData, "LEVEL_BOX_DATA_CLIPPED");
+    if (procID() == 0)
+    {
+        // the clipped patches must not make the chunks too small to compress
+        hid_t file = H5Fopen("LEVEL_BOX_DATA_CLIPPED.hdf5", H5F_ACC_RDONLY, H5P_DEFAULT);
+        hid_t dataset = H5Dopen2(file, "/level_0/data:datatype=0", H5P_DEFAULT);
+        hid_t space = H5Dget_space(dataset);
+        EXPECT_EQ(H5Sget_simple_extent_npoints(space), region.size()*C);
+        EXPECT_LT(H5Dget_storage_size(dataset), region.size()*C*sizeof(double));
+        H5Sclose(space);
+        H5Dclose(dataset);
+        H5Fclose(file);
+    }
+    LevelBoxData<double, C, HOST> readClipped;
+    h5.readLevel(readClipped, layout, Point::Zeros(), "LEVEL_BOX_DATA_CLIPPED");
+    for (auto iter : layout)
+    {
+        Box clipped = layout[iter] & region;
+        if (clipped.empty()) { continue; }
+        BoxData<double, C, HOST> read_i(clipped);
+        readClipped[iter].copyTo(read_i);
+        EXPECT_TRUE(compareBoxData(writeData[iter], read_i));
+    }
+}
+#endif
+
 #ifdef PROTO_ACCEL
 TEST(LevelBoxData, ExchangeDevice)
 {
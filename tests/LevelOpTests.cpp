@@ -130,6 +130,103 @@ TEST(LevelOp, ApplyBCPeriodic) {
     EXPECT_LT(error, 1e-12);
 }
 
+TEST(LevelOp, FluxWorkspace) {
+    int domainSize = 32;
+    Point boxSize = Point::Ones(domainSize / 4);
+    auto layout = testLayout(domainSize, boxSize);
+    Array<double, DIM> dx = Point::Ones();
+    dx /= domainSize;
+    LevelOp<BoxOp_TestLaplace, double> op(layout, dx);
+    typedef BoxOp_TestLaplace<double> OP;
+
+    // borrowed fluxes live on the faces of each patch and reuse the same buffer
+    const double* buffer = nullptr;
+    for (auto iter : layout)
+    {
+        auto& fluxes = op.fluxes(iter);
+        for (int dir = 0; dir < DIM; dir++)
+        {
+            EXPECT_EQ(fluxes[dir].box(), layout[iter].grow(dir, Side::Hi, 1));
+        }
+        if (buffer == nullptr) { buffer = fluxes[0].data(); }
+        EXPECT_EQ(fluxes[0].data(), buffer);
+    }
+    
+    // a larger box enlarges the workspace
+    Box bigBox = layout[*layout.begin()].grow(OP::ghost() + Point::Ones());
+    auto& bigFluxes = op.fluxes(bigBox);
+    for (int dir = 0; dir < DIM; dir++)
+    {
+        EXPECT_EQ(bigFluxes[dir].box(), bigBox.grow(dir, Side::Hi, 1));
+        bigFluxes[dir].setVal(dir);
+    }
+    for (int dir = 0; dir < DIM; dir++)
+    {
+        EXPECT_EQ(bigFluxes[dir].absMax(), dir);
+    }
+
+    // applying the operator with the workspace matches the BoxOp
+    double a0 = 0.125;
+    Array<double, DIM> k{1,1,1,1,1,1};
+    Array<double, DIM> a{a0, a0, a0, a0, a0, a0};
+    LevelBoxData<double, 1> srcData(layout, OP::ghost());
+    LevelBoxData<double, 1> dstData(layout, Point::Zeros());
+    srcData.initialize(f_phi, dx, k, a);
+    op(dstData, srcData);
+    for (auto iter : layout)
+    {
+        BoxData<double, 1> dst_i(layout[iter]);
+        op[iter](dst_i, srcData[iter]);
+        dst_i -= dstData[iter];
+        EXPECT_LT(dst_i.absMax(), 1e-12);
+    }
+}
+
+TEST(LevelOp, FluxWorkspaceThreads) {
+    int domainSize = 32;
+    Point boxSize = Point::Ones(domainSize / 4);
+    auto layout = testLayout(domainSize, boxSize);
+    Array<double, DIM> dx = Point::Ones();
+    dx /= domainSize;
+    typedef BoxOp_TestLaplace<double> OP;
+    auto& pool = ThreadPool::getPool();
+    unsigned int numThreads = pool.numThreads();
+    pool.setNumThreads(1);
+    LevelOp<BoxOp_TestLaplace, double> op(layout, dx);
+
+    // threads added after define get their own workspaces
+    pool.setNumThreads(4);
+    std::vector<const double*> buffers(pool.numThreads(), nullptr);
+    pool.forEach(64, [&](unsigned int a_task)
+    {
+        auto& fluxes = op.fluxes(Box::Cube(4 + a_task % 4));
+        buffers[ThreadPool::threadID()] = fluxes[0].data();
+    });
+    for (int ii = 0; ii < buffers.size(); ii++)
+    {
+        for (int jj = 0; jj < ii; jj++)
+        {
+            if (buffers[ii] != nullptr) { EXPECT_NE(buffers[ii], buffers[jj]); }
+        }
+    }
+
+    double a0 = 0.125;
+    Array<double, DIM> k{1,1,1,1,1,1};
+    Array<double, DIM> a{a0, a0, a0, a0, a0, a0};
+    LevelBoxData<double, 1> srcData(layout, OP::ghost());
+    LevelBoxData<double, 1> dstData(layout, Point::Zeros());
+    srcData.initialize(f_phi, dx, k, a);
+    op(dstData, srcData);
+    pool.setNumThreads(numThreads);
+    for (auto iter : layout)
+    {
+        BoxData<double, 1> dst_i(layout[iter]);
+        op[iter](dst_i, srcData[iter]);
+        dst_i -= dstData[iter];
+        EXPECT_LT(dst_i.absMax(), 1e-12);
+    }
+}
+
 int main(int argc, char *argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 #ifdef PR_MPI
@@ -73,7 +73,7 @@ TEST(MBLevelBoxData, Construction) {
                 EXPECT_EQ(layout.block(bounds[0].localIndex), blockID);
                 EXPECT_EQ(layout.block(bounds[0].adjIndex), xBlock);
                 EXPECT_EQ(bounds[0].localData->box(), patchBoundary.grow(boundGhost));
-                EXPECT_EQ(bounds[0].adjData->box(), adjPatchBoundary.grow(boundGhost));
+                EXPECT_EQ(bounds[0].adjDataBox, adjPatchBoundary.grow(boundGhost));
             } else if (patchDomain.adjacent(ny,1).contains(neighbor))
             {
                 EXPECT_EQ(bounds.size(), 1);
@@ -84,7 +84,7 @@ TEST(MBLevelBoxData, Construction) {
                 EXPECT_EQ(layout.block(bounds[0].localIndex), blockID);
                 EXPECT_EQ(layout.block(bounds[0].adjIndex), yBlock);
                 EXPECT_EQ(bounds[0].localData->box(), patchBoundary.grow(boundGhost));
-                EXPECT_EQ(bounds[0].adjData->box(), adjPatchBoundary.grow(boundGhost));
+                EXPECT_EQ(bounds[0].adjDataBox, adjPatchBoundary.grow(boundGhost));
             } else if (patchDomain.adjacent(nx+ny,1).contains(neighbor))
             {
                 EXPECT_EQ(bounds.size(), numBlocks-3);
@@ -99,7 +99,7 @@ TEST(MBLevelBoxData, Construction) {
                     EXPECT_NE(layout.block(bound.adjIndex), yBlock);
                     EXPECT_NE(layout.block(bound.adjIndex), xBlock);
                     EXPECT_EQ(bound.localData->box(), patchBoundary.grow(boundGhost));
-                    EXPECT_EQ(bound.adjData->box(), adjPatchBoundary.grow(boundGhost));
+                    EXPECT_EQ(bound.adjDataBox, adjPatchBoundary.grow(boundGhost));
                 }
             } else {
                 EXPECT_EQ(bounds.size(), 0);
@@ -109,6 +109,43 @@ TEST(MBLevelBoxData, Construction) {
 }
 #endif
 #if 1
+TEST(MBLevelBoxData, BoundaryPool) {
+    int domainSize = 32;
+    int boxSize = 16;
+    int numBlocks = 5;
+    auto domain = buildXPoint(domainSize, numBlocks);
+    Point boxSizeVect = Point::Ones(boxSize);
+    MBDisjointBoxLayout layout(domain, boxSizeVect);
+    Array<Point, DIM+1> ghost;
+    ghost.fill(Point::Ones());
+    Point boundGhost = Point::Ones();
+    MBLevelBoxData<int, NCOMP, HOST> hostData(layout, ghost, boundGhost);
+
+    size_t poolSize;
+    int* pool = hostData.boundaryBuffer(poolSize);
+    size_t totalSize = 0;
+    int* next = pool;
+    for (auto iter : layout)
+    {
+        for (auto dir : Box::Kernel(1))
+        {
+            for (auto& bound : hostData.bounds(iter, dir))
+            {
+                // buffers are laid out back to back in the order of the records;
+                // the exchange rotates straight into localData, so adjData is not stored
+                EXPECT_EQ(bound.localData->data(), next);
+                EXPECT_EQ(bound.adjData, nullptr);
+                next += bound.localData->size();
+                totalSize += bound.localData->size();
+            }
+        }
+    }
+    EXPECT_GT(totalSize, 0);
+    EXPECT_EQ(totalSize, poolSize);
+    EXPECT_EQ(next, pool + poolSize);
+}
+#endif
+#if 1
 TEST(MBLevelBoxData, Initialization) {
     int domainSize = 64;
     int boxSize = 16;
@@ -165,7 +202,7 @@ TEST(MBLevelBoxData, FillBoundaries) {
             for (auto bound : bounds)
             {
                 auto& localData = *bound.localData;
-                BoxData<double, DIM, HOST> adj(bound.adjData->box());
+                BoxData<double, DIM, HOST> adj(bound.adjDataBox);
                 BoxData<double, DIM, HOST> localSoln(bound.localData->box());
                 BoxData<double, DIM, HOST> error(bound.localData->box());
                 auto adjBlock = layout.block(bound.adjIndex);
@@ -199,6 +199,62 @@ TEST(MBLevelMapTests, CellApplyBoundary_Shear)
     }
 }
 
+TEST(MBLevelMapTests, CellApplyBatched_Shear)
+{
+    int domainSize = 8;
+    int boxSize = 4;
+
+    auto domain = buildShear(domainSize);
+    Point boxSizeVect = Point::Ones(boxSize);
+    MBDisjointBoxLayout layout(domain, boxSizeVect);
+
+    Array<Point, DIM+1> ghost;
+    ghost.fill(Point::Ones(4));
+    ghost[0] = Point::Ones(1);
+
+    MBLevelMap_Shear<HOST> map;
+    map.define(layout, ghost);
+    MBLevelBoxData<double, 1, HOST> data(layout, ghost);
+
+    // all block boundary ghost cells, seen from both blocks
+    std::vector<MBDataPoint> points;
+    for (auto iter : layout)
+    {
+        for (auto dir : Box::Kernel(1))
+        {
+            for (auto bound : data.bounds(iter, dir))
+            {
+                Box boundBox = layout[iter].adjacent(ghost[0]*dir);
+                auto adjBlock = layout.block(bound.adjIndex);
+                for (auto bi : boundBox)
+                {
+                    points.push_back(MBDataPoint(iter, bi, layout));
+                    points.push_back(MBDataPoint(iter, bi, layout, dir, adjBlock));
+                }
+            }
+        }
+    }
+    EXPECT_GT(points.size(), 0);
+    for (int pass = 0; pass < 2; pass++)
+    {
+        // the second pass is served from the cache
+        auto XCtr = map.cellCentered(points);
+        auto XAvg = map.cellAveraged(points);
+        for (int ii = 0; ii < points.size(); ii++)
+        {
+            auto& pi = points[ii];
+            Box B0(pi.point, pi.point);
+            auto XCtr_i = map.cellCentered(B0, pi.srcBlock(), pi.dstBlock());
+            auto XAvg_i = map.cellAveraged(B0, pi.srcBlock(), pi.dstBlock());
+            for (int dir = 0; dir < DIM; dir++)
+            {
+                EXPECT_NEAR(XCtr[ii][dir], XCtr_i(pi.point, dir), 1e-12);
+                EXPECT_NEAR(XAvg[ii][dir], XAvg_i(pi.point, dir), 1e-12);
+            }
+        }
+    }
+}
+
 #if DIM > 2
 TEST(MBLevelMapTests, CubeSphereShell) {
     int domainSize = 8;
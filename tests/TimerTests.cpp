@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+#include "Proto.H"
+#include <sstream>
+#include <thread>
+#include <filesystem>
+
+using namespace Proto;
+
+#ifndef PR_TURN_OFF_TIMERS
+namespace {
+    struct TimerEntry
+    {
+        int depth;
+        std::string name;
+        long long int count;
+    };
+
+    std::string timerFile()
+    {
+        return "TimerTests." + std::to_string(procID()) + ".time.table";
+    }
+
+    // Writes a timer report and returns the entries of its full tree
+    std::vector<TimerEntry> reportedTimers()
+    {
+        PR_TIMER_REPORT();
+        std::ifstream file(timerFile());
+        std::vector<std::string> lines;
+        std::string line;
+        size_t reportStart = 0;
+        while (std::getline(file, line))
+        {
+            if (line.find("Timer report") == 0) { reportStart = lines.size() + 2; }
+            lines.push_back(line);
+        }
+        std::vector<TimerEntry> entries;
+        for (size_t ii = reportStart; ii < lines.size(); ii++)
+        {
+            const std::string& entry = lines[ii];
+            if (entry.find("-----") == 0) { break; }
+            size_t rankStart = entry.find('[');
+            if (rankStart == std::string::npos) { continue; }
+            std::istringstream tokens(entry.substr(entry.find(']') + 1));
+            TimerEntry timer;
+            double time;
+            std::string percent;
+            timer.depth = rankStart / 3;
+            tokens >> timer.name >> time >> percent >> timer.count;
+            entries.push_back(timer);
+        }
+        return entries;
+    }
+
+    long long int totalCount(const std::vector<TimerEntry>& a_entries, std::string a_name)
+    {
+        long long int count = 0;
+        for (auto& entry : a_entries)
+        {
+            if (entry.name == a_name) { count += entry.count; }
+        }
+        return count;
+    }
+
+    void timedChild()
+    {
+        PR_TIME("TimerTests::child");
+    }
+
+    void timedParent(const char* a_name)
+    {
+        PR_TIME(a_name);
+        timedChild();
+    }
+
+    void fineTimer()
+    {
+        PR_TIME_FINE("TimerTests::fine");
+    }
+
+    void ringTimer()
+    {
+        PR_TIME("TimerTests::ring");
+    }
+
+    // Returns the number of lines of a trace file which contain a_pattern
+    int traceLines(std::string a_file, std::string a_pattern)
+    {
+        std::ifstream file(a_file);
+        std::string line;
+        int count = 0;
+        while (std::getline(file, line))
+        {
+            if (line.find(a_pattern) != std::string::npos) { count++; }
+        }
+        return count;
+    }
+}
+
+TEST(Timer, Threads) {
+    PR_TIMER_SETFILE(timerFile());
+    auto& pool = ThreadPool::getPool();
+    unsigned int numThreads = pool.numThreads();
+    pool.setNumThreads(4);
+    pool.forEach(64, [](unsigned int a_task)
+    {
+        PR_TIME("TimerTests::task");
+    });
+    pool.setNumThreads(numThreads);
+    auto entries = reportedTimers();
+    EXPECT_EQ(totalCount(entries, "TimerTests::task"), 64);
+    for (auto& entry : entries)
+    {
+        if (entry.name == "TimerTests::task") { EXPECT_EQ(entry.depth, 1); }
+    }
+}
+
+TEST(Timer, CallPath) {
+    PR_TIMER_SETFILE(timerFile());
+    for (int ii = 0; ii < 3; ii++)
+    {
+        timedParent("TimerTests::parentA");
+        timedParent("TimerTests::parentB");
+    }
+    auto entries = reportedTimers();
+    int numChildren = 0;
+    for (int ii = 0; ii < entries.size(); ii++)
+    {
+        if (entries[ii].name != "TimerTests::child") { continue; }
+        numChildren++;
+        EXPECT_EQ(entries[ii].count, 3);
+        EXPECT_EQ(entries[ii].depth, 2);
+        EXPECT_EQ(entries[ii-1].depth, 1);
+        EXPECT_EQ(entries[ii-1].name.find("TimerTests::parent"), 0);
+    }
+    EXPECT_EQ(numChildren, 2);
+    // the merged tree is reused, so a second report must not count the timers twice
+    EXPECT_EQ(totalCount(reportedTimers(), "TimerTests::child"), 6);
+}
+
+TEST(Timer, Level) {
+    PR_TIMER_SETFILE(timerFile());
+    fineTimer();
+    auto entries = reportedTimers();
+#if PR_TIMER_LEVEL >= 2
+    EXPECT_EQ(totalCount(entries, "TimerTests::fine"), 1);
+#else
+    EXPECT_EQ(totalCount(entries, "TimerTests::fine"), 0);
+#endif
+}
+
+TEST(Timer, PerfCounters) {
+    long long int before[PerfCounters::NUM_COUNTERS];
+    long long int after[PerfCounters::NUM_COUNTERS];
+    PerfCounters::read(before);
+    volatile double sum = 0;
+    for (int ii = 0; ii < 100000; ii++) { sum = sum + ii; }
+    PerfCounters::read(after);
+    if (PerfCounters::available())
+    {
+        EXPECT_GT(after[PerfCounters::CYCLES], before[PerfCounters::CYCLES]);
+        EXPECT_GT(after[PerfCounters::INSTRUCTIONS], before[PerfCounters::INSTRUCTIONS]);
+    } else {
+        EXPECT_FALSE(PerfCounters::error().empty());
+        for (int ii = 0; ii < PerfCounters::NUM_COUNTERS; ii++) { EXPECT_EQ(after[ii], 0); }
+    }
+#ifdef __linux__
+    // the counters of a thread are closed when it exits
+    auto numFiles = []()
+    {
+        int count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator("/proc/self/fd")) { count++; }
+        return count;
+    };
+    int filesBefore = numFiles();
+    std::thread reader([]()
+    {
+        long long int values[PerfCounters::NUM_COUNTERS];
+        PerfCounters::read(values);
+    });
+    reader.join();
+    EXPECT_EQ(numFiles(), filesBefore);
+#endif
+#ifdef PR_PERF_COUNTERS
+    PR_TIMER_SETFILE(timerFile());
+    PR_TIMER_REPORT();
+    std::ifstream file(timerFile());
+    std::string line;
+    int numSections = 0;
+    while (std::getline(file, line))
+    {
+        if (line.find("Hardware counters") == 0) { numSections++; }
+    }
+    EXPECT_GT(numSections, 0);
+#endif
+}
+
+TEST(Timer, Roofline) {
+#ifdef PR_ROOFLINE
+    // the probe allocates three arrays of Roofline::s_streamSize doubles
+    auto peaks = Roofline::probe(1);
+    EXPECT_GT(peaks.bandwidth, 0);
+    EXPECT_GT(peaks.flops, 0);
+#endif
+
+    Box box = Box::Cube(16);
+    BoxData<double> src(box.grow(1));
+    BoxData<double> dst(box);
+    src.setVal(1.0);
+    auto L = Stencil<double>::Laplacian();
+    Roofline::reset();
+    dst |= L(src);
+    forallInPlaceOp(2, "TimerTests::roofline",
+        [] PROTO_LAMBDA (Var<double>& a_dst, Var<double>& a_src)
+        {
+            a_dst(0) += 0.5*a_src(0);
+        }, dst, src);
+    auto stencil = Roofline::total("Stencil(" + std::to_string(L.size()) + " points)");
+    auto kernel = Roofline::total("TimerTests::roofline");
+#ifdef PR_ROOFLINE
+    EXPECT_EQ(stencil.calls, 1);
+    EXPECT_EQ(stencil.flops, L.numFlops(box));
+    EXPECT_EQ(stencil.bytes, (box.grow(1).size() + box.size())*sizeof(double));
+    EXPECT_EQ(kernel.calls, 1);
+    EXPECT_EQ(kernel.flops, 2*box.size());
+    EXPECT_EQ(kernel.bytes, 2*box.size()*sizeof(double));
+    EXPECT_EQ(Roofline::total("forall").calls, 0);
+
+    setenv("PR_ROOFLINE_PEAKS", "10,10", 1);
+    PR_TIMER_SETFILE(timerFile());
+    PR_TIMER_REPORT();
+    unsetenv("PR_ROOFLINE_PEAKS");
+    std::ifstream file(timerFile());
+    std::string line;
+    int numKernels = 0;
+    while (std::getline(file, line))
+    {
+        if (line.find("TimerTests::roofline") == 0) { numKernels++; }
+    }
+    EXPECT_EQ(numKernels, 1);
+#else
+    EXPECT_EQ(stencil.calls, 0);
+    EXPECT_EQ(kernel.calls, 0);
+#endif
+}
+
+TEST(Timer, Trace) {
+    PR_TIMER_SETFILE(timerFile());
+    std::string traceFile = "TimerTests.trace.json";
+    TimerTrace::enable(traceFile, 1024);
+    auto& pool = ThreadPool::getPool();
+    unsigned int numThreads = pool.numThreads();
+    pool.setNumThreads(4);
+    pool.forEach(64, [](unsigned int a_task)
+    {
+        PR_TIME("TimerTests::traced");
+    });
+    pool.setNumThreads(numThreads);
+    PR_TRACE_MESSAGE("TimerTests::message", 1, 100);
+    PR_TIMER_REPORT();
+    if (procID() == 0)
+    {
+        EXPECT_EQ(traceLines(traceFile, "\"TimerTests::traced\",\"ph\":\"X\""), 64*numProc());
+        EXPECT_EQ(traceLines(traceFile, "\"peer\":1,\"bytes\":100"), numProc());
+        EXPECT_EQ(traceLines(traceFile, "\"droppedEvents\":0"), 1);
+    }
+
+    // only the last events are kept when a buffer is full
+    TimerTrace::enable(traceFile, 4);
+    for (int ii = 0; ii < 10; ii++) { ringTimer(); }
+    PR_TIMER_REPORT();
+    if (procID() == 0)
+    {
+        EXPECT_EQ(traceLines(traceFile, "\"TimerTests::ring\""), 4*numProc());
+        EXPECT_EQ(traceLines(traceFile, "\"droppedEvents\":" + std::to_string(6*numProc())), 1);
+    }
+}
+
+#ifdef PR_MPI
+template<typename T, unsigned int C, MemType MEM, Centering CTR>
+class NeighborExchangeCopier : public LevelExchangeCopier<T, C, MEM, CTR>
+{
+    public:
+    NeighborExchangeCopier() { this->setNeighborCollective(true); }
+};
+
+template<typename T, unsigned int C, MemType MEM, Centering CTR>
+class SharedMemoryExchangeCopier : public LevelExchangeCopier<T, C, MEM, CTR>
+{
+    public:
+    SharedMemoryExchangeCopier() { this->setSharedMemory(true); }
+};
+
+TEST(Timer, TraceCopier) {
+    PR_TIMER_SETFILE(timerFile());
+    std::string traceFile = "TimerTests.copier.trace.json";
+    int domainSize = 32;
+    std::array<bool, DIM> periodicity;
+    periodicity.fill(true);
+    ProblemDomain domain(Point::Ones(domainSize), periodicity);
+    DisjointBoxLayout layout(domain, Point::Ones(domainSize/2));
+    LevelBoxData<double, 1, HOST> neighborData(layout, Point::Ones());
+    LevelBoxData<double, 1, HOST> sharedData(layout, Point::Ones());
+    neighborData.defineExchange<NeighborExchangeCopier>();
+    sharedData.defineExchange<SharedMemoryExchangeCopier>();
+    TimerTrace::enable(traceFile, 1024);
+    neighborData.exchange();
+    sharedData.exchange();
+    PR_TIMER_REPORT();
+    if (procID() == 0 && numProc() > 1)
+    {
+        // every rank exchanges ghost cells with every other rank of a periodic layout
+        EXPECT_EQ(traceLines(traceFile, "\"MPI_Ineighbor_alltoallv:send\""), numProc()*(numProc()-1));
+        EXPECT_EQ(traceLines(traceFile, "\"MPI_Ineighbor_alltoallv:recv\""), numProc()*(numProc()-1));
+        EXPECT_GT(traceLines(traceFile, "\"MPI_Win_shared:write\""), 0);
+        EXPECT_GT(traceLines(traceFile, "\"MPI_Win_shared:read\""), 0);
+    }
+}
+#endif
+#endif
+
+int main(int argc, char *argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+#ifdef PR_MPI
+    MPI_Init(&argc, &argv);
+#endif
+    int result = RUN_ALL_TESTS();
+#ifdef PR_MPI
+    MPI_Finalize();
+#endif
+    return result;
+}